@@ -3,17 +3,33 @@
 // Distributed under the MIT software license, see the accompanying
 // file COPYING or http://www.opensource.org/licenses/mit-license.php.
 
+#include <algorithm>
+#include <cstdint>
 #include <stdexcept>
+#include <utility>
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Only use mmap where address space is plentiful.
+#if defined(__linux__) && SIZE_MAX > 0xffffffffU
+#define FLATFILE_USE_MMAP
+#endif
 
 #include <flatfile.h>
 #include <logging.h>
 #include <tinyformat.h>
 #include <util/system.h>
 
-FlatFileSeq::FlatFileSeq(fs::path dir, const char* prefix, size_t chunk_size) :
+FlatFileSeq::FlatFileSeq(fs::path dir, const char* prefix, size_t chunk_size, size_t extend_ahead) :
     m_dir(std::move(dir)),
     m_prefix(prefix),
-    m_chunk_size(chunk_size)
+    m_chunk_size(chunk_size),
+    m_extend_ahead(extend_ahead)
 {
     if (chunk_size == 0) {
         throw std::invalid_argument("chunk_size must be positive");
@@ -49,9 +65,87 @@ FILE* FlatFileSeq::Open(const FlatFilePos& pos, bool read_only)
         fclose(file);
         return nullptr;
     }
+#if defined(__linux__)
+    // Flat files are written once, front to back, and mostly read the same
+    // way; ask for aggressive readahead.
+    posix_fadvise(fileno(file), 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
     return file;
 }
 
+void FlatFileSeq::Drop(const FlatFilePos& pos)
+{
+#if defined(__linux__)
+    FILE* file = Open(FlatFilePos(pos.nFile, 0), true);
+    if (file) {
+        posix_fadvise(fileno(file), 0, 0, POSIX_FADV_DONTNEED);
+        fclose(file);
+    }
+#endif
+}
+
+FlatFileSeq::MappedView::MappedView(MappedView&& other) noexcept
+{
+    *this = std::move(other);
+}
+
+FlatFileSeq::MappedView& FlatFileSeq::MappedView::operator=(MappedView&& other) noexcept
+{
+    if (this != &other) {
+#ifdef FLATFILE_USE_MMAP
+        if (m_base) munmap(m_base, m_map_len);
+#endif
+        m_base = other.m_base;
+        m_map_len = other.m_map_len;
+        m_data = other.m_data;
+        m_size = other.m_size;
+        other.m_base = nullptr;
+        other.m_map_len = 0;
+        other.m_data = nullptr;
+        other.m_size = 0;
+    }
+    return *this;
+}
+
+FlatFileSeq::MappedView::~MappedView()
+{
+#ifdef FLATFILE_USE_MMAP
+    if (m_base) munmap(m_base, m_map_len);
+#endif
+}
+
+FlatFileSeq::MappedView FlatFileSeq::Map(const FlatFilePos& pos, size_t len)
+{
+    MappedView view;
+#ifdef FLATFILE_USE_MMAP
+    if (pos.IsNull() || len == 0) {
+        return view;
+    }
+    FILE* file = Open(FlatFilePos(pos.nFile, 0), true); // Avoid fseek to nPos
+    if (!file) {
+        return view;
+    }
+    struct stat st;
+    if (fstat(fileno(file), &st) == 0 && static_cast<off_t>(pos.nPos) < st.st_size) {
+        len = std::min(len, static_cast<size_t>(st.st_size - pos.nPos));
+        // mmap requires a page-aligned offset; map from the enclosing page
+        // boundary and expose the requested sub-slice.
+        const size_t page_mask = static_cast<size_t>(sysconf(_SC_PAGESIZE)) - 1;
+        size_t base_off = pos.nPos & ~page_mask;
+        size_t slack = pos.nPos - base_off;
+        void* base = mmap(nullptr, len + slack, PROT_READ, MAP_PRIVATE, fileno(file), base_off);
+        if (base != MAP_FAILED) {
+            view.m_base = base;
+            view.m_map_len = len + slack;
+            view.m_data = static_cast<const unsigned char*>(base) + slack;
+            view.m_size = len;
+        }
+    }
+    fclose(file);
+#endif
+    return view;
+}
+
 size_t FlatFileSeq::Allocate(const FlatFilePos& pos, size_t add_size, bool& out_of_space)
 {
     out_of_space = false;
@@ -61,6 +155,14 @@ size_t FlatFileSeq::Allocate(const FlatFilePos& pos, size_t add_size, bool& out_
     if (n_new_chunks > n_old_chunks) {
         size_t old_size = pos.nPos;
         size_t new_size = n_new_chunks * m_chunk_size;
+        if (m_extend_ahead > 0) {
+            // Extend far enough that at least m_extend_ahead bytes beyond the new
+            // data are pre-allocated. Later chunk crossings inside this range find
+            // their extents already reserved, so the filesystem sees fewer, larger
+            // extent-tree updates.
+            size_t ahead_chunks = (pos.nPos + add_size + m_extend_ahead + m_chunk_size - 1) / m_chunk_size;
+            new_size = std::max(new_size, ahead_chunks * m_chunk_size);
+        }
         size_t inc_size = new_size - old_size;
 
         if (CheckDiskSpace(m_dir, inc_size)) {
@@ -78,6 +180,15 @@ size_t FlatFileSeq::Allocate(const FlatFilePos& pos, size_t add_size, bool& out_
     return 0;
 }
 
+void FlatFileSeq::StartWriteback(const FlatFilePos& pos)
+{
+    FILE* file = Open(FlatFilePos(pos.nFile, 0)); // Avoid fseek to nPos
+    if (file) {
+        StartFileWriteback(file);
+        fclose(file);
+    }
+}
+
 bool FlatFileSeq::Flush(const FlatFilePos& pos, bool finalize)
 {
     FILE* file = Open(FlatFilePos(pos.nFile, 0)); // Avoid fseek to nPos
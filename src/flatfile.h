@@ -55,6 +55,7 @@ private:
     const fs::path m_dir;
     const char* const m_prefix;
     const size_t m_chunk_size;
+    const size_t m_extend_ahead;
 
 public:
     /**
@@ -63,15 +64,57 @@ public:
      * @param dir The base directory that all files live in.
      * @param prefix A short prefix given to all file names.
      * @param chunk_size Disk space is pre-allocated in multiples of this amount.
+     * @param extend_ahead Minimum number of bytes to keep pre-allocated beyond the
+     * requested position, so sequential writers extend files in fewer, larger steps.
      */
-    FlatFileSeq(fs::path dir, const char* prefix, size_t chunk_size);
+    FlatFileSeq(fs::path dir, const char* prefix, size_t chunk_size, size_t extend_ahead = 0);
 
     /** Get the name of the file at the given position. */
     fs::path FileName(const FlatFilePos& pos) const;
 
+    /**
+     * Read-only memory-mapped view of part of a file in the sequence, as returned by Map. The
+     * view owns the mapping; the data is unmapped when the view is destroyed.
+     */
+    class MappedView
+    {
+    public:
+        MappedView() {}
+        MappedView(MappedView&& other) noexcept;
+        MappedView& operator=(MappedView&& other) noexcept;
+        ~MappedView();
+
+        MappedView(const MappedView&) = delete;
+        MappedView& operator=(const MappedView&) = delete;
+
+        //! Whether the mapping succeeded.
+        explicit operator bool() const { return m_data != nullptr; }
+        const unsigned char* data() const { return m_data; }
+        size_t size() const { return m_size; }
+
+    private:
+        friend class FlatFileSeq;
+
+        void* m_base = nullptr;                //!< Page-aligned base address passed to munmap.
+        size_t m_map_len = 0;                  //!< Length of the whole mapping.
+        const unsigned char* m_data = nullptr; //!< Start of the requested slice.
+        size_t m_size = 0;                     //!< Length of the requested slice.
+    };
+
     /** Open a handle to the file at the given position. */
     FILE* Open(const FlatFilePos& pos, bool read_only = false);
 
+    /**
+     * Map a read-only view of up to len bytes of the file at the given position, avoiding the
+     * buffer copy of a read through Open. The view is clamped to the end of the file. Returns
+     * an empty view if mapping is unsupported on this platform or fails for any reason;
+     * callers are expected to fall back to Open.
+     *
+     * @param[in] pos The position of the first byte to be mapped.
+     * @param[in] len The maximum number of bytes to map.
+     */
+    MappedView Map(const FlatFilePos& pos, size_t len);
+
     /**
      * Allocate additional space in a file after the given starting position. The amount allocated
      * will be the minimum multiple of the sequence chunk size greater than add_size.
@@ -83,6 +126,24 @@ public:
      */
     size_t Allocate(const FlatFilePos& pos, size_t add_size, bool& out_of_space);
 
+    /**
+     * Hint the OS that cached pages of the file at the given position will not be needed again,
+     * freeing page cache for data that is still hot. Useful once a file has been finalized and
+     * synced. Advisory; a no-op on platforms without posix_fadvise.
+     *
+     * @param[in] pos The position of the file to drop from the page cache.
+     */
+    void Drop(const FlatFilePos& pos);
+
+    /**
+     * Hint the OS to begin writing back dirty pages of the file at the given position without
+     * waiting for them to reach disk. Calling this before Flush on several files lets their
+     * writeback overlap instead of serializing on each file's commit barrier.
+     *
+     * @param[in] pos The position of the file to start writing back.
+     */
+    void StartWriteback(const FlatFilePos& pos);
+
     /**
      * Commit a file to disk, and optionally truncate off extra pre-allocated bytes if final.
      *
@@ -5,6 +5,7 @@
 #include <interfaces/handler.h>
 
 #include <util/memory.h>
+#include <util/signal.h>
 
 #include <boost/signals2/connection.hpp>
 #include <utility>
@@ -22,6 +23,17 @@ public:
     boost::signals2::scoped_connection m_connection;
 };
 
+class SignalHandlerImpl : public Handler
+{
+public:
+    explicit SignalHandlerImpl(util::SignalConnection connection) : m_connection(std::move(connection)) {}
+    ~SignalHandlerImpl() override { m_connection.disconnect(); }
+
+    void disconnect() override { m_connection.disconnect(); }
+
+    util::SignalConnection m_connection;
+};
+
 } // namespace
 
 std::unique_ptr<Handler> MakeHandler(boost::signals2::connection connection)
@@ -29,4 +41,9 @@ std::unique_ptr<Handler> MakeHandler(boost::signals2::connection connection)
     return MakeUnique<HandlerImpl>(std::move(connection));
 }
 
+std::unique_ptr<Handler> MakeHandler(util::SignalConnection connection)
+{
+    return MakeUnique<SignalHandlerImpl>(std::move(connection));
+}
+
 } // namespace interfaces
@@ -13,6 +13,10 @@ class connection;
 } // namespace signals2
 } // namespace boost
 
+namespace util {
+class SignalConnection;
+} // namespace util
+
 namespace interfaces {
 
 //! Generic interface for managing an event handler or callback function
@@ -30,6 +34,9 @@ public:
 //! Return handler wrapping a boost signal connection.
 std::unique_ptr<Handler> MakeHandler(boost::signals2::connection connection);
 
+//! Return handler wrapping a util::Signal connection.
+std::unique_ptr<Handler> MakeHandler(util::SignalConnection connection);
+
 } // namespace interfaces
 
 #endif // BITCOIN_INTERFACES_HANDLER_H
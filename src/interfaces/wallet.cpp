@@ -513,7 +513,9 @@ public:
     std::shared_ptr<CWallet> m_wallet;
 };
 
-class WalletClientImpl : public ChainClient
+//! final so calls through a WalletClientImpl pointer or reference can be
+//! devirtualized; external code only sees the ChainClient interface.
+class WalletClientImpl final : public ChainClient
 {
 public:
     WalletClientImpl(Chain& chain, std::vector<std::string> wallet_filenames)
@@ -8,15 +8,14 @@
 #include <ui_interface.h>
 #include <util/system.h>
 
-#include <string>
+#include <util/signal.h>
 
-#include <boost/signals2/connection.hpp>
-#include <boost/signals2/signal.hpp>
+#include <string>
 
 /** Store connections so we can disconnect them when suppressing output */
-boost::signals2::connection noui_ThreadSafeMessageBoxConn;
-boost::signals2::connection noui_ThreadSafeQuestionConn;
-boost::signals2::connection noui_InitMessageConn;
+util::SignalConnection noui_ThreadSafeMessageBoxConn;
+util::SignalConnection noui_ThreadSafeQuestionConn;
+util::SignalConnection noui_InitMessageConn;
 
 bool noui_ThreadSafeMessageBox(const std::string& message, const std::string& caption, unsigned int style)
 {
@@ -8,6 +8,7 @@
 
 #include <support/allocators/zeroafterfree.h>
 #include <serialize.h>
+#include <span.h>
 
 #include <algorithm>
 #include <assert.h>
@@ -193,6 +194,54 @@ public:
     }
 };
 
+/** Minimal stream for reading from an existing byte buffer by reference
+ */
+class SpanReader
+{
+private:
+    const int m_type;
+    const int m_version;
+    Span<const unsigned char> m_data;
+
+public:
+
+    /**
+     * @param[in]  type Serialization Type
+     * @param[in]  version Serialization Version (including any flags)
+     * @param[in]  data Referenced byte buffer to read from
+     */
+    SpanReader(int type, int version, Span<const unsigned char> data)
+        : m_type(type), m_version(version), m_data(data) {}
+
+    template<typename T>
+    SpanReader& operator>>(T& obj)
+    {
+        // Unserialize from this stream
+        ::Unserialize(*this, obj);
+        return (*this);
+    }
+
+    int GetVersion() const { return m_version; }
+    int GetType() const { return m_type; }
+
+    size_t size() const { return m_data.size(); }
+    bool empty() const { return m_data.size() == 0; }
+
+    void read(char* dst, size_t n)
+    {
+        if (n == 0) {
+            return;
+        }
+
+        // Read from the beginning of the buffer
+        if (n > static_cast<size_t>(m_data.size())) {
+            throw std::ios_base::failure("SpanReader::read(): end of data");
+        }
+        memcpy(dst, m_data.data(), n);
+        m_data = m_data.subspan(n);
+    }
+};
+
 /** Double ended buffer combining vector and stream-like interfaces.
  *
  * >> and << read and write unformatted data using the above serialization templates.
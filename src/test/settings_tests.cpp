@@ -8,7 +8,12 @@
 #include <test/util/str.h>
 
 
+#include <algorithm>
+#include <array>
 #include <boost/test/unit_test.hpp>
+#include <cassert>
+#include <cstdio>
+#include <cstring>
 #include <univalue.h>
 #include <util/strencodings.h>
 #include <vector>
@@ -68,24 +73,38 @@ struct MergeTestingSetup : public BasicTestingSetup {
     static constexpr int MAX_ACTIONS = 3;
 
     enum Action { END, SET, NEGATE, SECTION_SET, SECTION_NEGATE };
-    using ActionList = Action[MAX_ACTIONS];
+    using ActionList = std::array<Action, MAX_ACTIONS>;
 
-    //! Enumerate all possible test configurations.
+    //! Enumerate all valid action lists in the range [min_action, max_action].
+    static std::vector<ActionList> ListActions(Action min_action, Action max_action)
+    {
+        std::vector<ActionList> lists;
+        Action actions[MAX_ACTIONS] = {};
+        ForEachNoDup(actions, min_action, max_action, [&] {
+            lists.emplace_back();
+            std::copy(std::begin(actions), std::end(actions), lists.back().begin());
+        });
+        return lists;
+    }
+
+    //! Enumerate all possible test configurations. The action lists are
+    //! precomputed once so the test body runs in plain nested loops instead of
+    //! inside nested enumeration callbacks.
     template <typename Fn>
     void ForEachMergeSetup(Fn&& fn)
     {
-        ActionList arg_actions = {};
         // command_line_options do not have sections. Only iterate over SET and NEGATE
-        ForEachNoDup(arg_actions, SET, NEGATE, [&]{
-            ActionList conf_actions = {};
-            ForEachNoDup(conf_actions, SET, SECTION_NEGATE, [&]{
+        const std::vector<ActionList> arg_lists = ListActions(SET, NEGATE);
+        const std::vector<ActionList> conf_lists = ListActions(SET, SECTION_NEGATE);
+        for (const ActionList& arg_actions : arg_lists) {
+            for (const ActionList& conf_actions : conf_lists) {
                 for (bool force_set : {false, true}) {
                     for (bool ignore_default_section_config : {false, true}) {
                         fn(arg_actions, conf_actions, force_set, ignore_default_section_config);
                     }
                 }
-            });
-        });
+            }
+        }
     }
 };
 
@@ -103,29 +122,64 @@ BOOST_FIXTURE_TEST_CASE(Merge, MergeTestingSetup)
     }
 
     const std::string& network = CBaseChainParams::MAIN;
+    // Scratch buffer reused across iterations so the dump path allocates once
+    // instead of growing a fresh string every time.
+    std::string desc;
+    desc.reserve(512);
     ForEachMergeSetup([&](const ActionList& arg_actions, const ActionList& conf_actions, bool force_set,
                           bool ignore_default_section_config) {
-        std::string desc;
+        desc.clear();
         int value_suffix = 0;
         util::Settings settings;
 
+        // Stream each output fragment straight into the hasher rather than
+        // materializing the full line first; desc is only assembled when
+        // dumping results to a file.
+        struct Output {
+            CHash256& sha;
+            std::string* dump;
+            void operator()(const char* s, size_t len)
+            {
+                sha.Write((const unsigned char*)s, len);
+                if (dump) dump->append(s, len);
+            }
+            void operator()(const char* s) { (*this)(s, strlen(s)); }
+            void operator()(const std::string& s) { (*this)(s.data(), s.size()); }
+        } out{out_sha, out_file ? &desc : nullptr};
+
         const std::string& name = ignore_default_section_config ? "wallet" : "server";
         auto push_values = [&](Action action, const char* value_prefix, const std::string& name_prefix,
                                std::vector<util::SettingsValue>& dest) {
             if (action == SET || action == SECTION_SET) {
                 for (int i = 0; i < 2; ++i) {
-                    dest.push_back(value_prefix + std::to_string(++value_suffix));
-                    desc += " " + name_prefix + name + "=" + dest.back().get_str();
+                    // Format the value on the stack instead of going through
+                    // std::to_string and string concatenation; the result is
+                    // short enough to stay in the small-string buffer when
+                    // stored below. This loop runs tens of thousands of times.
+                    char value[16];
+                    int value_len = snprintf(value, sizeof(value), "%s%d", value_prefix, ++value_suffix);
+                    assert(value_len > 0 && value_len < (int)sizeof(value));
+                    dest.push_back(std::string(value, value_len));
+                    out(" ");
+                    out(name_prefix);
+                    out(name);
+                    out("=");
+                    out(value, value_len);
                 }
             } else if (action == NEGATE || action == SECTION_NEGATE) {
                 dest.push_back(false);
-                desc += " " + name_prefix + "no" + name;
+                out(" ");
+                out(name_prefix);
+                out("no");
+                out(name);
             }
         };
 
         if (force_set) {
             settings.forced_settings[name] = "forced";
-            desc += " " + name + "=forced";
+            out(" ");
+            out(name);
+            out("=forced");
         }
         for (Action arg_action : arg_actions) {
             push_values(arg_action, "a", "-", settings.command_line_options[name]);
@@ -136,18 +190,17 @@ BOOST_FIXTURE_TEST_CASE(Merge, MergeTestingSetup)
                 settings.ro_config[use_section ? network : ""][name]);
         }
 
-        desc += " || ";
-        desc += GetSetting(settings, network, name, ignore_default_section_config, /* get_chain_name= */ false).write();
-        desc += " |";
+        out(" || ");
+        out(GetSetting(settings, network, name, ignore_default_section_config, /* get_chain_name= */ false).write());
+        out(" |");
         for (const auto& s : GetSettingsList(settings, network, name, ignore_default_section_config)) {
-            desc += " ";
-            desc += s.write();
+            out(" ");
+            out(s.write());
         }
-        desc += " |";
-        if (OnlyHasDefaultSectionSetting(settings, network, name)) desc += " ignored";
-        desc += "\n";
+        out(" |");
+        if (OnlyHasDefaultSectionSetting(settings, network, name)) out(" ignored");
+        out("\n");
 
-        out_sha.Write((const unsigned char*)desc.data(), desc.size());
         if (out_file) {
             BOOST_REQUIRE(fwrite(desc.data(), 1, desc.size(), out_file) == desc.size());
         }
@@ -4,30 +4,31 @@
 
 #include <ui_interface.h>
 
-#include <boost/signals2/last_value.hpp>
-#include <boost/signals2/signal.hpp>
+#include <util/signal.h>
 
 CClientUIInterface uiInterface;
 
+// Like boost::signals2's last_value combiner, the bool signals below return
+// the result of the last connected slot (see util::Signal).
 struct UISignals {
-    boost::signals2::signal<CClientUIInterface::ThreadSafeMessageBoxSig, boost::signals2::last_value<bool>> ThreadSafeMessageBox;
-    boost::signals2::signal<CClientUIInterface::ThreadSafeQuestionSig, boost::signals2::last_value<bool>> ThreadSafeQuestion;
-    boost::signals2::signal<CClientUIInterface::InitMessageSig> InitMessage;
-    boost::signals2::signal<CClientUIInterface::NotifyNumConnectionsChangedSig> NotifyNumConnectionsChanged;
-    boost::signals2::signal<CClientUIInterface::NotifyNetworkActiveChangedSig> NotifyNetworkActiveChanged;
-    boost::signals2::signal<CClientUIInterface::NotifyAlertChangedSig> NotifyAlertChanged;
-    boost::signals2::signal<CClientUIInterface::LoadWalletSig> LoadWallet;
-    boost::signals2::signal<CClientUIInterface::ShowProgressSig> ShowProgress;
-    boost::signals2::signal<CClientUIInterface::NotifyBlockTipSig> NotifyBlockTip;
-    boost::signals2::signal<CClientUIInterface::NotifyHeaderTipSig> NotifyHeaderTip;
-    boost::signals2::signal<CClientUIInterface::BannedListChangedSig> BannedListChanged;
+    util::Signal<CClientUIInterface::ThreadSafeMessageBoxSig> ThreadSafeMessageBox;
+    util::Signal<CClientUIInterface::ThreadSafeQuestionSig> ThreadSafeQuestion;
+    util::Signal<CClientUIInterface::InitMessageSig> InitMessage;
+    util::Signal<CClientUIInterface::NotifyNumConnectionsChangedSig> NotifyNumConnectionsChanged;
+    util::Signal<CClientUIInterface::NotifyNetworkActiveChangedSig> NotifyNetworkActiveChanged;
+    util::Signal<CClientUIInterface::NotifyAlertChangedSig> NotifyAlertChanged;
+    util::Signal<CClientUIInterface::LoadWalletSig> LoadWallet;
+    util::Signal<CClientUIInterface::ShowProgressSig> ShowProgress;
+    util::Signal<CClientUIInterface::NotifyBlockTipSig> NotifyBlockTip;
+    util::Signal<CClientUIInterface::NotifyHeaderTipSig> NotifyHeaderTip;
+    util::Signal<CClientUIInterface::BannedListChangedSig> BannedListChanged;
 };
 static UISignals g_ui_signals;
 
-#define ADD_SIGNALS_IMPL_WRAPPER(signal_name)                                                                 \
-    boost::signals2::connection CClientUIInterface::signal_name##_connect(std::function<signal_name##Sig> fn) \
-    {                                                                                                         \
-        return g_ui_signals.signal_name.connect(fn);                                                          \
+#define ADD_SIGNALS_IMPL_WRAPPER(signal_name)                                                             \
+    util::SignalConnection CClientUIInterface::signal_name##_connect(std::function<signal_name##Sig> fn) \
+    {                                                                                                     \
+        return g_ui_signals.signal_name.connect(std::move(fn));                                           \
     }
 
 ADD_SIGNALS_IMPL_WRAPPER(ThreadSafeMessageBox);
@@ -6,16 +6,13 @@
 #ifndef BITCOIN_UI_INTERFACE_H
 #define BITCOIN_UI_INTERFACE_H
 
+#include <util/signal.h>
+
 #include <functional>
 #include <memory>
 #include <string>
 
 class CBlockIndex;
-namespace boost {
-namespace signals2 {
-class connection;
-}
-} // namespace boost
 
 namespace interfaces {
 class Wallet;
@@ -80,10 +77,10 @@ public:
         MSG_ERROR = (ICON_ERROR | BTN_OK | MODAL)
     };
 
-#define ADD_SIGNALS_DECL_WRAPPER(signal_name, rtype, ...)                                  \
-    rtype signal_name(__VA_ARGS__);                                                        \
-    using signal_name##Sig = rtype(__VA_ARGS__);                                           \
-    boost::signals2::connection signal_name##_connect(std::function<signal_name##Sig> fn);
+#define ADD_SIGNALS_DECL_WRAPPER(signal_name, rtype, ...)                         \
+    rtype signal_name(__VA_ARGS__);                                               \
+    using signal_name##Sig = rtype(__VA_ARGS__);                                  \
+    util::SignalConnection signal_name##_connect(std::function<signal_name##Sig> fn);
 
     /** Show message box. */
     ADD_SIGNALS_DECL_WRAPPER(ThreadSafeMessageBox, bool, const std::string& message, const std::string& caption, unsigned int style);
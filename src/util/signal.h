@@ -0,0 +1,135 @@
+// Copyright (c) 2020 The Bitcoin Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef BITCOIN_UTIL_SIGNAL_H
+#define BITCOIN_UTIL_SIGNAL_H
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace util {
+
+template <typename Signature>
+class Signal;
+
+namespace detail {
+//! Slot list shared between a Signal and its connections. Slots are
+//! type-erased here so SignalConnection does not need to be a template.
+struct SignalSlots {
+    std::mutex mutex;
+    std::vector<std::shared_ptr<void>> slots;
+};
+} // namespace detail
+
+//! Handle to a slot registered with a Signal. Default-constructed handles are
+//! empty, and disconnect() is a no-op if the slot or the signal is already
+//! gone, so handles can safely outlive both.
+class SignalConnection
+{
+public:
+    SignalConnection() = default;
+
+    //! Remove the slot from the signal it was registered with.
+    void disconnect()
+    {
+        std::shared_ptr<detail::SignalSlots> shared = m_shared.lock();
+        std::shared_ptr<void> slot = m_slot.lock();
+        if (!shared || !slot) return;
+        std::lock_guard<std::mutex> lock(shared->mutex);
+        shared->slots.erase(std::remove(shared->slots.begin(), shared->slots.end(), slot), shared->slots.end());
+    }
+
+    //! Whether the slot is still registered.
+    bool connected() const { return !m_slot.expired(); }
+
+private:
+    template <typename Signature>
+    friend class Signal;
+
+    SignalConnection(std::shared_ptr<detail::SignalSlots> shared, std::shared_ptr<void> slot)
+        : m_shared(std::move(shared)), m_slot(std::move(slot))
+    {
+    }
+
+    std::weak_ptr<detail::SignalSlots> m_shared;
+    std::weak_ptr<void> m_slot;
+};
+
+//! Minimal thread-safe signal/slot implementation. Connecting, disconnecting
+//! and emitting may happen concurrently from different threads. Slots run
+//! outside the internal lock in the order they were connected, and for
+//! non-void signatures emitting returns the result of the last slot (a
+//! default-constructed value if no slots are connected). Unlike
+//! boost::signals2 there is no per-slot tracking or combiner machinery, which
+//! keeps both the emit path and the compiled code size small.
+template <typename Signature>
+class Signal
+{
+public:
+    using Slot = std::function<Signature>;
+    using Result = typename Slot::result_type;
+
+    Signal() : m_shared(std::make_shared<detail::SignalSlots>()) {}
+    Signal(const Signal&) = delete;
+    Signal& operator=(const Signal&) = delete;
+
+    //! Append a slot and return a handle that can disconnect it.
+    SignalConnection connect(Slot fn)
+    {
+        std::shared_ptr<Slot> slot = std::make_shared<Slot>(std::move(fn));
+        std::lock_guard<std::mutex> lock(m_shared->mutex);
+        m_shared->slots.push_back(slot);
+        return SignalConnection(m_shared, std::move(slot));
+    }
+
+    //! Invoke all connected slots with the given arguments.
+    template <typename... Args>
+    Result operator()(Args&&... args) const
+    {
+        return Emit(std::is_void<Result>(), std::forward<Args>(args)...);
+    }
+
+private:
+    //! Copy the current slots so they can be invoked without holding the lock
+    //! (slots may connect or disconnect other slots while running).
+    std::vector<std::shared_ptr<Slot>> Snapshot() const
+    {
+        std::lock_guard<std::mutex> lock(m_shared->mutex);
+        std::vector<std::shared_ptr<Slot>> snapshot;
+        snapshot.reserve(m_shared->slots.size());
+        for (const std::shared_ptr<void>& slot : m_shared->slots) {
+            snapshot.push_back(std::static_pointer_cast<Slot>(slot));
+        }
+        return snapshot;
+    }
+
+    template <typename... Args>
+    void Emit(std::true_type, Args&&... args) const
+    {
+        for (const std::shared_ptr<Slot>& slot : Snapshot()) {
+            (*slot)(args...);
+        }
+    }
+
+    template <typename... Args>
+    Result Emit(std::false_type, Args&&... args) const
+    {
+        Result result{};
+        for (const std::shared_ptr<Slot>& slot : Snapshot()) {
+            result = (*slot)(args...);
+        }
+        return result;
+    }
+
+    std::shared_ptr<detail::SignalSlots> m_shared;
+};
+
+} // namespace util
+
+#endif // BITCOIN_UTIL_SIGNAL_H
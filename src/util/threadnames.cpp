@@ -41,16 +41,26 @@ static void SetThreadName(const char* name)
 #if defined(HAVE_THREAD_LOCAL)
 
 static thread_local std::string g_thread_name;
+//! The internal name formatted for log lines, composed once per rename rather
+//! than once per log call.
+static thread_local std::string g_thread_name_log_prefix = "[] ";
 const std::string& util::ThreadGetInternalName() { return g_thread_name; }
+const std::string& util::ThreadGetInternalNameLogPrefix() { return g_thread_name_log_prefix; }
 //! Set the in-memory internal name for this thread. Does not affect the process
 //! name.
-static void SetInternalName(std::string name) { g_thread_name = std::move(name); }
+static void SetInternalName(std::string name)
+{
+    g_thread_name = std::move(name);
+    g_thread_name_log_prefix = "[" + g_thread_name + "] ";
+}
 
 // Without thread_local available, don't handle internal name at all.
 #else
 
 static const std::string empty_string;
+static const std::string empty_log_prefix = "[] ";
 const std::string& util::ThreadGetInternalName() { return empty_string; }
+const std::string& util::ThreadGetInternalNameLogPrefix() { return empty_log_prefix; }
 static void SetInternalName(std::string name) { }
 #endif
 
@@ -21,6 +21,11 @@ void ThreadSetInternalName(std::string&&);
 //! logging.
 const std::string& ThreadGetInternalName();
 
+//! Get the thread's internal name formatted as a log line prefix ("[name] ").
+//! Composed when the thread is renamed, so hot logging paths can prepend it
+//! without allocating temporaries.
+const std::string& ThreadGetInternalNameLogPrefix();
+
 } // namespace util
 
 #endif // BITCOIN_UTIL_THREADNAMES_H
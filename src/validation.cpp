@@ -1135,6 +1135,20 @@ bool ReadBlockFromDisk(CBlock& block, const FlatFilePos& pos, const Consensus::P
 {
     block.SetNull();
 
+    // Try a zero-copy read from a mapped view of the block file, avoiding the
+    // buffer copy of the stdio path below. The mapped length is an upper
+    // bound; deserialization stops at the end of the block.
+    if (const FlatFileSeq::MappedView view = BlockFileSeq().Map(pos, MAX_BLOCK_SERIALIZED_SIZE)) {
+        try {
+            SpanReader{SER_DISK, CLIENT_VERSION, {view.data(), static_cast<std::ptrdiff_t>(view.size())}} >> block;
+        } catch (const std::exception& e) {
+            return error("%s: Deserialize or I/O error - %s at %s", __func__, e.what(), pos.ToString());
+        }
+        if (!CheckProofOfWork(block.GetHash(), block.nBits, consensusParams))
+            return error("ReadBlockFromDisk: Errors in block header at %s", pos.ToString());
+        return true;
+    }
+
     // Open history file to read
     CAutoFile filein(OpenBlockFile(pos, true), SER_DISK, CLIENT_VERSION);
     if (filein.IsNull())
@@ -1738,12 +1752,24 @@ void static FlushBlockFile(bool fFinalize = false)
     FlatFilePos block_pos_old(nLastBlockFile, vinfoBlockFile[nLastBlockFile].nSize);
     FlatFilePos undo_pos_old(nLastBlockFile, vinfoBlockFile[nLastBlockFile].nUndoSize);
 
+    // Kick off writeback of both files before waiting on either, so the two
+    // commit barriers below overlap their data I/O instead of running serially.
+    BlockFileSeq().StartWriteback(block_pos_old);
+    UndoFileSeq().StartWriteback(undo_pos_old);
+
     bool status = true;
     status &= BlockFileSeq().Flush(block_pos_old, fFinalize);
     status &= UndoFileSeq().Flush(undo_pos_old, fFinalize);
     if (!status) {
         AbortNode("Flushing block file to disk failed. This is likely the result of an I/O error.");
     }
+
+    if (fFinalize) {
+        // These files will not be written to again; drop their pages from the
+        // cache to leave room for data that is still hot.
+        BlockFileSeq().Drop(block_pos_old);
+        UndoFileSeq().Drop(undo_pos_old);
+    }
 }
 
 static bool FindUndoPos(BlockValidationState &state, int nFile, FlatFilePos &pos, unsigned int nAddSize);
@@ -3943,7 +3969,7 @@ static void FindFilesToPrune(std::set<int>& setFilesToPrune, uint64_t nPruneAfte
     // We don't check to prune until after we've allocated new space for files
     // So we should leave a buffer under our target to account for another allocation
     // before the next pruning.
-    uint64_t nBuffer = BLOCKFILE_CHUNK_SIZE + UNDOFILE_CHUNK_SIZE;
+    uint64_t nBuffer = BLOCKFILE_CHUNK_SIZE + BLOCKFILE_EXTEND_AHEAD + UNDOFILE_CHUNK_SIZE;
     uint64_t nBytesToPrune;
     int count=0;
 
@@ -3986,7 +4012,7 @@ static void FindFilesToPrune(std::set<int>& setFilesToPrune, uint64_t nPruneAfte
 
 static FlatFileSeq BlockFileSeq()
 {
-    return FlatFileSeq(GetBlocksDir(), "blk", BLOCKFILE_CHUNK_SIZE);
+    return FlatFileSeq(GetBlocksDir(), "blk", BLOCKFILE_CHUNK_SIZE, BLOCKFILE_EXTEND_AHEAD);
 }
 
 static FlatFileSeq UndoFileSeq()